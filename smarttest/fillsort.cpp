@@ -68,6 +68,25 @@ struct R
 
 #endif
 
+//
+// C -- Like R, but counts every reference count operation, to show the
+// copies (and moves, under C++11) done by the containers and algorithms.
+//
+struct C
+    : ref::counter<C>
+    , S {
+    static unsigned long	ops;
+    C          		       *__ref_getptr()  { return this; }
+    unsigned int		__ref_inc() throw() { ++ops; return ref::counter<C>::__ref_inc(); }
+    unsigned int		__ref_dec() { ++ops; return ref::counter<C>::__ref_dec(); }
+};
+unsigned long			C::ops		= 0;
+
+template <typename obj>
+unsigned long counter_ops() { return 0; }
+template <>
+unsigned long counter_ops<C>() { return C::ops; }
+
 using namespace std;
 //using namespace boost;
 
@@ -78,13 +97,36 @@ void test_fill_sort( int N )
    printf( "Testing %s\n", typeid(ptr_obj).name() );
 
    {  clock_t start = clock();
+      unsigned long ops = counter_ops<obj>();
       vector<ptr_obj> container;
       for (int i = 0; i < N; i++ )
          container.push_back(ptr_obj(new obj()));
       printf("fill vector: %ld\n",(long)clock() - start);
+      if ( counter_ops<obj>() )
+         printf("  counter ops: %lu\n", counter_ops<obj>() - ops);
+      ops = counter_ops<obj>();
       sort(container.begin(), container.end());
       printf("sort vector: %ld\n",(long)clock() - start);
+      if ( counter_ops<obj>() )
+         printf("  counter ops: %lu\n", counter_ops<obj>() - ops);
+   }
+#if __cplusplus >= 201103L
+   {  // The same, but sorting relocatable elements (eg. ref::ptr) bitwise
+      clock_t start = clock();
+      unsigned long ops = counter_ops<obj>();
+      vector<ptr_obj> container;
+      for (int i = 0; i < N; i++ )
+         container.push_back(ptr_obj(new obj()));
+      printf("fill vector: %ld\n",(long)clock() - start);
+      if ( counter_ops<obj>() )
+         printf("  counter ops: %lu\n", counter_ops<obj>() - ops);
+      ops = counter_ops<obj>();
+      ref::sort(container.data(), container.data() + container.size());
+      printf("sort vector (ref::sort): %ld\n",(long)clock() - start);
+      if ( counter_ops<obj>() )
+         printf("  counter ops: %lu\n", counter_ops<obj>() - ops);
    }
+#endif
    {  clock_t start = clock();
       list<ptr_obj> container;
       for (int i = 0; i < N; i++ )
@@ -123,6 +165,13 @@ int main( int, char** ) {
    test_fill_sort<ref::ptr_tiny<S>, S             >( N );
    test_fill_sort<ref::ptr_fast<R>, R             >( N );
    test_fill_sort<ref::ptr_fast<S>, S             >( N );
+   test_fill_sort<ref::ptr_tiny<C>, C             >( N );
+   test_fill_sort<ref::ptr_fast<C>, C             >( N );
+
+#if defined( REF_PTR_POOL )
+   // ref::ptr_tiny<S> and ref::ptr_fast<S> control blocks came from ref::pool
+   printf( "ref::pool released: %lu bytes\n", (unsigned long)ref::pool::release() );
+#endif
 
    return 0;
 }
@@ -210,6 +210,12 @@ void test_data_sizes()
    std::cout << "# sizeof( boost::cyclic_ptr<B> )          " << sizeof ( boost::cyclic_ptr<B>          ) << std::endl;
    std::cout << "# sizeof( ref::ptr_tiny<R> )              " << sizeof ( ref::ptr_tiny<R>              ) << std::endl;
    std::cout << "# sizeof( ref::ptr_fast<R> )              " << sizeof ( ref::ptr_fast<R>              ) << std::endl;
+#if __cplusplus >= 201103L
+   std::cout << "# sizeof( ref::handle<S> )                " << sizeof ( ref::handle<S>                ) << std::endl;
+#endif
+#if defined( REF_PTR_POOL )
+   std::cout << "# ref::count_other<S> allocated from ref::pool (REF_PTR_POOL)" << std::endl;
+#endif
 }
 
 int main()